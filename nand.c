@@ -3,49 +3,17 @@
 
 // The function creates a new gate with the indicated number of inputs:
 //  n (number of inputs).
-// Possible returned results of the function are:
+// Function uses helper function allocate_nand (definition of which can be
+// found in the file nand_helper.c). Possible returned results of the function are:
 //  pointer to a gate - if everything succeeded,
 //  NULL - if a memory allocation error occurred.
 nand_t* nand_new(unsigned n) {
-  nand_t *new_nand = (nand_t*) malloc(sizeof(nand_t));
+  nand_t *new_nand = allocate_nand(n);
   if (new_nand == NULL) {
     errno = ENOMEM;
     return NULL;
   }
 
-  new_nand->counter_in = n;
-  new_nand->counter_ocupied = 0;
-
-  new_nand->set_in = (void**) malloc(n * sizeof(void*));
-  if (new_nand->set_in == NULL) {
-    free(new_nand);
-    errno = ENOMEM;
-    return NULL;
-  }
-
-  new_nand->set_in_content = (int*) malloc(n * sizeof(int));
-  if (new_nand->set_in_content == NULL) {
-    free(new_nand->set_in);
-    free(new_nand);
-    errno = ENOMEM;
-    return NULL;
-  }
-
-  for (unsigned i = 0; i < n; ++i) {
-    new_nand->set_in[i] = NULL;
-    new_nand->set_in_content[i] = 0;
-  }
-
-  new_nand->counter_out = 0;
-  new_nand->head_out = NULL;
-  new_nand->tail_out = NULL;
-
-  new_nand->record_created = false;
-  new_nand->record_finished = false;
-  new_nand->to_be_visited = 0;
-  new_nand->record_found_false = false;
-  new_nand->record_critical_path = 0;
-
   return new_nand;
 }
 
@@ -66,9 +34,6 @@ void nand_delete(nand_t *g) {
     if (g->set_in_content[i] == 2) delete_node_from_nand(
         (nand_t*) (g->set_in[i]) , g);
 
-  free(g->set_in_content);
-  free(g->set_in);
-
   delete_list_from_nand(g);
 
   free(g);
@@ -369,3 +334,180 @@ nand_t* nand_output(nand_t const *g, ssize_t k) {
 
   return current->nand_pointer;
 }
+
+// The function creates a copy of the indicated gate:
+//  current (pointer to the gate to be copied),
+// unless it has already been copied within the current execution
+// of the nand_clone function, and appends the gate to the end of the array
+// of gates that have been copied, enlarging the array if needed. Additional
+// parameters of the function are:
+//  visited - pointer to the pointer to the array of gates that have been
+//            copied,
+//  counter - pointer to the number of gates in the same array,
+//  capacity - pointer to the number of places allocated for the same array.
+// The possible results of the function are:
+//  0 - if all is successful,
+//  -1 - if a memory allocation error occurred.
+static int nand_clone_visit(nand_t *current,
+                            nand_t ***visited,
+                            size_t *counter,
+                            size_t *capacity) {
+  if (current->record_clone != NULL) {
+    return 0;
+  }
+
+  if (*counter == *capacity) {
+    nand_t **enlarged = (nand_t**) realloc(*visited,
+                                           2 * *capacity * sizeof(nand_t*));
+    if (enlarged == NULL) {
+      return -1;
+    }
+    *visited = enlarged;
+    *capacity *= 2;
+  }
+
+  current->record_clone = allocate_nand(current->counter_in);
+  if (current->record_clone == NULL) {
+    return -1;
+  }
+  (*visited)[(*counter)++] = current;
+
+  return 0;
+}
+
+// The function releases the copies created so far within the current
+// execution of the nand_clone function and clears the record_clone field
+// of every gate that has been copied. The parameters of the function are:
+//  visited - pointer to an array of pointers to the gates that have been
+//            copied,
+//  counter - number of gates pointed to by the pointers in visited.
+// The result of the function is:
+//  void.
+static void nand_clone_abort(nand_t **visited, size_t counter) {
+  for (size_t i = 0; i < counter; ++i) {
+    nand_delete(visited[i]->record_clone);
+    visited[i]->record_clone = NULL;
+  }
+  free(visited);
+}
+
+// The function creates a copy of the graph formed by the indicated gates
+// and all gates whose outputs are connected, directly or indirectly,
+// to their inputs. Each gate is copied exactly once: the gates are visited
+// in the order in which they are discovered and the copy of each gate is kept
+// in its record_clone field, so the whole copy is made in time linear
+// in the number of gates and connections. The copies of the gates keep
+// the same boolean signals connected to their inputs as the original gates
+// and the same order of the gates connected to their outputs, but only
+// connections between copied gates are reproduced. Function uses helper
+// functions nand_clone_visit, allocate_nand and add_node_to_nand (definitions
+// of the latter two can be found in the file nand_helper.c). Parameters
+// of the function are:
+//  g – pointer to an array of pointers to gates to be copied,
+//  m – the size of the array pointed to by g,
+//  old_gates – pointer to a place where a pointer to a newly allocated array
+//              of pointers to all copied gates is to be stored,
+//  new_gates – pointer to a place where a pointer to a newly allocated array
+//              of pointers to the copies is to be stored; the copy
+//              of the gate old_gates[i] is pointed to by new_gates[i].
+// Both arrays are to be released by the caller with free, and the copies
+// with nand_delete.
+// The possible results of the function are:
+//  number of copied gates - if all is successful,
+//  -1 – if any pointer is NULL, m is equal to zero or a memory allocation
+//       error has occurred.
+ssize_t nand_clone(nand_t **g, size_t m,
+                   nand_t ***old_gates, nand_t ***new_gates) {
+  if (g == NULL || m < 1 || old_gates == NULL || new_gates == NULL) {
+    errno = EINVAL;
+    return -1;
+  }
+  for (size_t i = 0; i < m; ++i) {
+    if (g[i] == NULL) {
+      errno = EINVAL;
+      return -1;
+    }
+  }
+
+  size_t capacity = m;
+  size_t counter = 0;
+  nand_t **visited = (nand_t**) malloc(capacity * sizeof(nand_t*));
+  if (visited == NULL) {
+    errno = ENOMEM;
+    return -1;
+  }
+
+  // Discovery of gates and creation of their copies. Array visited serves
+  // as a queue - gates connected to the inputs of a visited gate are appended
+  // to it when they are found for the first time.
+  for (size_t i = 0; i < m; ++i) {
+    if (nand_clone_visit(g[i], &visited, &counter, &capacity) == -1) {
+      nand_clone_abort(visited, counter);
+      errno = ENOMEM;
+      return -1;
+    }
+  }
+  for (size_t i = 0; i < counter; ++i) {
+    nand_t *current = visited[i];
+    for (unsigned k = 0; k < current->counter_in; ++k) {
+      if (current->set_in_content[k] == 2 &&
+          nand_clone_visit((nand_t*) (current->set_in[k]),
+                           &visited, &counter, &capacity) == -1) {
+        nand_clone_abort(visited, counter);
+        errno = ENOMEM;
+        return -1;
+      }
+    }
+  }
+
+  // Reproduction of connections. Boolean signals are copied directly, while
+  // connections between gates are reproduced by walking the lists of gates
+  // connected to outputs, so that their order is preserved. Both ends
+  // of a connection are set at once, so the copy stays consistent even if
+  // a memory allocation error occurs.
+  for (size_t i = 0; i < counter; ++i) {
+    nand_t *current = visited[i];
+    nand_t *copy = current->record_clone;
+
+    for (unsigned k = 0; k < current->counter_in; ++k) {
+      if (current->set_in_content[k] == 1) {
+        copy->set_in[k] = current->set_in[k];
+        copy->set_in_content[k] = 1;
+        copy->counter_ocupied++;
+      }
+    }
+
+    for (const out_node *node = current->head_out;
+         node != NULL;
+         node = node->next) {
+      nand_t *target = (node->nand_pointer)->record_clone;
+      if (target == NULL) {
+        continue;
+      }
+      if (add_node_to_nand(copy, target, node->place) == -1) {
+        nand_clone_abort(visited, counter);
+        errno = ENOMEM;
+        return -1;
+      }
+      target->set_in[node->place] = (void*) copy;
+      target->set_in_content[node->place] = 2;
+      target->counter_ocupied++;
+    }
+  }
+
+  nand_t **copies = (nand_t**) malloc(counter * sizeof(nand_t*));
+  if (copies == NULL) {
+    nand_clone_abort(visited, counter);
+    errno = ENOMEM;
+    return -1;
+  }
+  for (size_t i = 0; i < counter; ++i) {
+    copies[i] = visited[i]->record_clone;
+    visited[i]->record_clone = NULL;
+  }
+
+  *old_gates = visited;
+  *new_gates = copies;
+
+  return (ssize_t) counter;
+}
@@ -1,6 +1,48 @@
 #include "nand_helper.h"
 #include "nand.h"
 
+// The function creates a new gate with the indicated number of inputs:
+//  n (number of inputs),
+// placing the structure of the gate and both of its arrays (set_in and
+// set_in_content) in a single block of memory, so that a gate can be created
+// with one allocation and released with one call to free. It is called
+// by the nand_new and nand_clone functions. The possible results
+// of the function are:
+//  pointer to the newly created gate - if all is successful,
+//  NULL - if a memory allocation error occurred.
+nand_t* allocate_nand(unsigned n) {
+  nand_t *new_nand = (nand_t*) malloc(sizeof(nand_t) +
+                                      n * sizeof(void*) +
+                                      n * sizeof(int));
+  if (new_nand == NULL) {
+    return NULL;
+  }
+
+  new_nand->counter_in = n;
+  new_nand->counter_ocupied = 0;
+
+  new_nand->set_in = (void**) (new_nand + 1);
+  new_nand->set_in_content = (int*) (new_nand->set_in + n);
+
+  for (unsigned i = 0; i < n; ++i) {
+    new_nand->set_in[i] = NULL;
+    new_nand->set_in_content[i] = 0;
+  }
+
+  new_nand->counter_out = 0;
+  new_nand->head_out = NULL;
+  new_nand->tail_out = NULL;
+
+  new_nand->record_created = false;
+  new_nand->record_finished = false;
+  new_nand->to_be_visited = 0;
+  new_nand->record_found_false = false;
+  new_nand->record_critical_path = 0;
+  new_nand->record_clone = NULL;
+
+  return new_nand;
+}
+
 // The function creates a new node containing the indicated:
 //  to_be_added (pointer to the gate to be inserted in the new list node),
 //  index (gate input number to be inserted in the new list node).
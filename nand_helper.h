@@ -70,7 +70,10 @@ typedef struct record_node {
 //                         record_critical_path value is equal to the length
 //                         of the maximum critical path found within current
 //                         execution of nand_evaluate_recursion function
-//                         (execution for the given nand gate).
+//                         (execution for the given nand gate),
+//  record_clone - pointer to the copy of the gate created within current
+//                 execution of nand_clone function, NULL if the gate has not
+//                 been copied (yet) or nand_clone is not being executed.
 struct nand {
   unsigned counter_in;
   unsigned counter_ocupied;
@@ -84,8 +87,10 @@ struct nand {
   bool record_finished;
   bool record_found_false;
   ssize_t  record_critical_path;
+  nand_t *record_clone;
 };
 
+nand_t* allocate_nand(unsigned n);
 int  add_node_to_nand(nand_t *to_be_added_to, nand_t *to_be_added, unsigned index);
 void delete_node_from_nand(nand_t *to_be_deleted_from, nand_t *to_be_deleted);
 void delete_list_from_nand(nand_t *to_be_deleted_from);